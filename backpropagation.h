@@ -60,11 +60,19 @@ public:
     Matrix<T, M, K> operator*(const Matrix<T, J, K>& rhs);
 };
 
+template<std::size_t N, typename T, T(*Activation)(T), T(*Derivative)(T), std::size_t I, std::size_t... L>
+requires std::floating_point<T>
+class BPNetPack;
+
 template<typename T, T(*Activation)(T), T(*Derivative)(T), std::size_t I, std::size_t... L>
 requires std::floating_point<T>
 class BPNet {
 private:
     using SubNetType = BPNet<T, Activation, Derivative, L...>;
+
+    template<std::size_t N, typename U, U(*A)(U), U(*D)(U), std::size_t J, std::size_t... K>
+    requires std::floating_point<U>
+    friend class BPNetPack;
 public:
     static constexpr T(*ACTIVATION)(T) = Activation;
     static constexpr T(*DERIVATIVE)(T) = Derivative;
@@ -126,6 +134,149 @@ public:
     Matrix<T, INPUTS, 1> train(const Matrix<T, INPUTS, 1>& input, const Matrix<T, OUTPUTS, 1>& output) { return output - input; }
 };
 
+// Pack of N networks with identical topology evaluated in lockstep.
+// Weights are stored structure-of-arrays: entry [n][i][p] is weight (n, i) of network p,
+// so the innermost loops run over the networks and map onto SIMD lanes.
+// Column p of every input/output matrix belongs to network p.
+template<std::size_t N, typename T, T(*Activation)(T), T(*Derivative)(T), std::size_t I, std::size_t... L>
+requires std::floating_point<T>
+class BPNetPack {
+private:
+    using SubPackType = BPNetPack<N, T, Activation, Derivative, L...>;
+public:
+    using NetType = BPNet<T, Activation, Derivative, I, L...>;
+    static constexpr T(*ACTIVATION)(T) = Activation;
+    static constexpr T(*DERIVATIVE)(T) = Derivative;
+    static constexpr std::size_t NETWORKS = N;
+    static constexpr std::size_t INPUTS = I;
+    static constexpr std::size_t OUTPUTS = SubPackType::OUTPUTS;
+private:
+    static constexpr std::size_t NEXT = SubPackType::INPUTS;
+
+    T m_weight[NEXT][INPUTS][N];
+    T m_bias[NEXT][N];
+    SubPackType m_sub;
+
+    Matrix<T, NEXT, N> forward(const Matrix<T, INPUTS, N>& input) const {
+        Matrix<T, NEXT, N> result;
+        for (std::size_t n = 0; n < NEXT; n++) {
+            T sum[N] = {};
+            for (std::size_t i = 0; i < INPUTS; i++) {
+                for (std::size_t p = 0; p < N; p++) {
+                    sum[p] += m_weight[n][i][p] * input(i, p);
+                }
+            }
+            for (std::size_t p = 0; p < N; p++) {
+                result(n, p) = ACTIVATION(sum[p] + m_bias[n][p]);
+            }
+        }
+        return result;
+    }
+public:
+    void setLearningRate(T lr) { m_sub.setLearningRate(lr); }
+    T getLearningRate() { return m_sub.getLearningRate(); }
+
+    void randomize(T min, T max) {
+        for (std::size_t n = 0; n < NEXT; n++) {
+            for (std::size_t i = 0; i < INPUTS; i++) {
+                for (std::size_t p = 0; p < N; p++) {
+                    m_weight[n][i][p] = random<T>(min, max);
+                }
+            }
+            for (std::size_t p = 0; p < N; p++) {
+                m_bias[n][p] = random<T>(min, max);
+            }
+        }
+        m_sub.randomize(min, max);
+    }
+
+    // copy network p out of the pack (learning rate of the pack is applied)
+    NetType extract(std::size_t p) {
+        NetType net;
+        extract(p, net);
+        net.setLearningRate(getLearningRate());
+        return net;
+    }
+
+    void extract(std::size_t p, NetType& net) const {
+        for (std::size_t n = 0; n < NEXT; n++) {
+            for (std::size_t i = 0; i < INPUTS; i++) {
+                net.m_weight(n, i) = m_weight[n][i][p];
+            }
+            net.m_bias(n, 0) = m_bias[n][p];
+        }
+        m_sub.extract(p, net.m_sub);
+    }
+
+    // overwrite network p of the pack (learning rate of the pack is kept)
+    void insert(std::size_t p, const NetType& net) {
+        for (std::size_t n = 0; n < NEXT; n++) {
+            for (std::size_t i = 0; i < INPUTS; i++) {
+                m_weight[n][i][p] = net.m_weight(n, i);
+            }
+            m_bias[n][p] = net.m_bias(n, 0);
+        }
+        m_sub.insert(p, net.m_sub);
+    }
+
+    Matrix<T, OUTPUTS, N> get(const Matrix<T, INPUTS, N>& input) {
+        return m_sub.get(forward(input));
+    }
+
+    Matrix<T, INPUTS, N> train(const Matrix<T, INPUTS, N>& input, const Matrix<T, OUTPUTS, N>& output) {
+        Matrix<T, NEXT, N> next_input = forward(input);
+        Matrix<T, NEXT, N> errors = m_sub.train(next_input, output);
+
+        T lr = getLearningRate();
+        for (std::size_t n = 0; n < NEXT; n++) {
+            T gradient[N];
+            for (std::size_t p = 0; p < N; p++) {
+                gradient[p] = DERIVATIVE(next_input(n, p)) * errors(n, p) * lr;
+            }
+            for (std::size_t i = 0; i < INPUTS; i++) {
+                for (std::size_t p = 0; p < N; p++) {
+                    m_weight[n][i][p] += gradient[p] * input(i, p);
+                }
+            }
+            for (std::size_t p = 0; p < N; p++) {
+                m_bias[n][p] += gradient[p];
+            }
+        }
+
+        Matrix<T, INPUTS, N> result(static_cast<T>(0.0));
+        for (std::size_t n = 0; n < NEXT; n++) {
+            for (std::size_t i = 0; i < INPUTS; i++) {
+                for (std::size_t p = 0; p < N; p++) {
+                    result(i, p) += m_weight[n][i][p] * errors(n, p);
+                }
+            }
+        }
+        return result;
+    }
+};
+
+template<std::size_t N, typename T, T(*Activation)(T), T(*Derivative)(T), std::size_t O>
+requires std::floating_point<T>
+class BPNetPack<N, T, Activation, Derivative, O> {
+public:
+    using NetType = BPNet<T, Activation, Derivative, O>;
+    static constexpr T(*ACTIVATION)(T) = Activation;
+    static constexpr T(*DERIVATIVE)(T) = Derivative;
+    static constexpr std::size_t NETWORKS = N;
+    static constexpr std::size_t INPUTS = O;
+    static constexpr std::size_t OUTPUTS = O;
+private:
+    T m_lr = static_cast<T>(0.002);
+public:
+    void setLearningRate(T lr) { m_lr = lr; }
+    T getLearningRate() { return m_lr; }
+    void randomize(T min, T max) {}
+    void extract(std::size_t p, NetType& net) const {}
+    void insert(std::size_t p, const NetType& net) {}
+    Matrix<T, OUTPUTS, N> get(const Matrix<T, INPUTS, N>& input) { return input; }
+    Matrix<T, INPUTS, N> train(const Matrix<T, INPUTS, N>& input, const Matrix<T, OUTPUTS, N>& output) { return output - input; }
+};
+
 template<typename T, std::size_t M, std::size_t N>
 Matrix<T, M, N>::Matrix(T v) {
     for (std::size_t m = 0; m < M; m++) {
@@ -0,0 +1,80 @@
+#include "backpropagation.h"
+#include "benchmark.h"
+#include <cmath>
+#include <iostream>
+
+float sigmoid(float x) { return 1.f / (1.f + std::exp(-x)); }
+float dsigmoid(float x) { return x * (1.f - x); }
+
+// One small network per sensor channel
+static constexpr std::size_t Channels = 256;
+static constexpr std::size_t PackSize = 16;
+static constexpr std::size_t Packs = Channels / PackSize;
+
+using NetType = BPNet<float, sigmoid, dsigmoid, 4, 8, 8, 1>;
+using PackType = BPNetPack<PackSize, float, sigmoid, dsigmoid, 4, 8, 8, 1>;
+
+static NetType nets[Channels];
+static PackType packs[Packs];
+static const Matrix<float, 4, 1> input { 0.5f };
+static const Matrix<float, 1, 1> output { 1.f };
+static const Matrix<float, 4, PackSize> pack_input { 0.5f };
+static const Matrix<float, 1, PackSize> pack_output { 1.f };
+
+void call_train() {
+    for (NetType& net : nets) {
+        net.train(input, output);
+    }
+}
+
+void call_get() {
+    for (NetType& net : nets) {
+        net.get(input);
+    }
+}
+
+void call_pack_train() {
+    for (PackType& pack : packs) {
+        pack.train(pack_input, pack_output);
+    }
+}
+
+void call_pack_get() {
+    for (PackType& pack : packs) {
+        pack.get(pack_input);
+    }
+}
+
+int main() {
+    // Randomize the packs and copy every network out so both sides start identically
+    for (std::size_t c = 0; c < Channels; c++) {
+        if (c % PackSize == 0) {
+            packs[c / PackSize].randomize(0.f, 1.f);
+        }
+        nets[c] = packs[c / PackSize].extract(c % PackSize);
+    }
+
+    std::cout << Channels << " networks one after another" << std::endl;
+    std::cout << "Train: ";
+    benchmark<>(call_train, 1000);
+    std::cout << "Get: ";
+    benchmark<>(call_get, 1000);
+
+    std::cout << Packs << " packs of " << PackSize << " networks" << std::endl;
+    std::cout << "Train: ";
+    benchmark<>(call_pack_train, 1000);
+    std::cout << "Get: ";
+    benchmark<>(call_pack_get, 1000);
+
+    // Both variants received the same training and have to agree
+    float max_difference = 0.f;
+    for (std::size_t c = 0; c < Channels; c++) {
+        float single = nets[c].get(input)(0, 0);
+        float packed = packs[c / PackSize].get(pack_input)(0, c % PackSize);
+        max_difference = std::max(max_difference, std::abs(single - packed));
+    }
+    std::cout << "Maximum difference between single and packed output: " << max_difference << std::endl;
+
+    // End of program
+    return 0;
+}